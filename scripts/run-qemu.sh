@@ -1 +1,51 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-3.0-or-later
+# OpenSovix QEMU启动脚本
+#
+# 用法:
+#   ./scripts/run-qemu.sh [single]        单机运行（与 make run 相同）
+#   ./scripts/run-qemu.sh listen [端口]   作为 virtio-net 对端等待连接
+#   ./scripts/run-qemu.sh connect [端口]  连接到另一台以 listen 启动的实例
+#
+# 两个实例通过 -netdev socket 在本机（127.0.0.1）直连，不经过任何外部网络。
+# 注意：socket 后端只有单队列且没有 vnet 头，QEMU 不会提供 MQ 和校验和
+# 卸载特性，因此这种组合只能测试单队列、无卸载的 virtio-net。
 
+set -e
+
+ISO=${ISO:-opensovix.iso}
+MODE=${1:-single}
+PORT=${2:-1234}
+
+usage() {
+    echo "usage: $0 [single] | $0 listen|connect [port]"
+    exit 1
+}
+
+[ $# -le 2 ] || usage
+[ "$MODE" != "single" ] || [ $# -le 1 ] || usage
+[[ "$PORT" =~ ^[0-9]+$ ]] && [ "$PORT" -ge 1 ] && [ "$PORT" -le 65535 ] || usage
+
+[ -f "$ISO" ] || { echo "$ISO not found, run make first"; exit 1; }
+command -v qemu-system-x86_64 >/dev/null 2>&1 || { echo "qemu-system-x86_64 not found"; exit 1; }
+
+args=(-cdrom "$ISO" -serial stdio -m 512M)
+
+# 每个实例使用不同的MAC地址，避免对端收到自己的地址
+case "$MODE" in
+    single)
+        ;;
+    listen)
+        args+=(-netdev "socket,id=net0,listen=127.0.0.1:$PORT")
+        args+=(-device virtio-net-pci,netdev=net0,mac=52:54:00:12:34:01)
+        ;;
+    connect)
+        args+=(-netdev "socket,id=net0,connect=127.0.0.1:$PORT")
+        args+=(-device virtio-net-pci,netdev=net0,mac=52:54:00:12:34:02)
+        ;;
+    *)
+        usage
+        ;;
+esac
+
+exec qemu-system-x86_64 "${args[@]}"